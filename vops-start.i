@@ -1,5 +1,8 @@
 autoload, "vops.i",
     vops_combine,
+    vops_dist1,
+    vops_dist2,
+    vops_distinf,
     vops_flops,
     vops_inner,
     vops_norm1,
@@ -8,4 +11,6 @@ autoload, "vops.i",
     vops_scale,
     vops_tic,
     vops_toc,
-    vops_update;
+    vops_update,
+    vops_wnorm1,
+    vops_wnorm2;
@@ -107,6 +107,66 @@ write, format="%35s ->", "vops_inner(w, x, y)";
 k = repeat; vops_warmup; while (--k >= 0) r2 = vops_inner(x, x, y);
 write, format="%14.6g / %7.3f Gflops\n\n", r2, vops_flops(nops*repeat)/1e9;
 
+// Distances.
+nops = 3*numberof(x);
+
+write, format="%35s ->", "sum(abs(x - y))";
+k = repeat; vops_warmup; while (--k >= 0) r1 = sum(abs(x - y));
+write, format="%14.6g / %7.3f Gflops\n", r1, vops_flops(nops*repeat)/1e9;
+
+write, format="%35s ->", "vops_dist1(x, y)";
+k = repeat; vops_warmup; while (--k >= 0) r2 = vops_dist1(x, y);
+write, format="%14.6g / %7.3f Gflops\n\n", r2, vops_flops(nops*repeat)/1e9;
+
+write, format="%35s ->", "sqrt(sum((x - y)^2))";
+k = repeat; vops_warmup; while (--k >= 0) r1 = sqrt(sum((x - y)^2));
+write, format="%14.6g / %7.3f Gflops\n", r1, vops_flops(nops*repeat)/1e9;
+
+write, format="%35s ->", "vops_dist2(x, y)";
+k = repeat; vops_warmup; while (--k >= 0) r2 = vops_dist2(x, y);
+write, format="%14.6g / %7.3f Gflops\n\n", r2, vops_flops(nops*repeat)/1e9;
+
+write, format="%35s ->", "max(abs(x - y))";
+k = repeat; vops_warmup; while (--k >= 0) r1 = max(abs(x - y));
+write, format="%14.6g / %7.3f Gflops\n", r1, vops_flops(nops*repeat)/1e9;
+
+write, format="%35s ->", "vops_distinf(x, y)";
+k = repeat; vops_warmup; while (--k >= 0) r2 = vops_distinf(x, y);
+write, format="%14.6g / %7.3f Gflops\n\n", r2, vops_flops(nops*repeat)/1e9;
+
+for (i = 1; i <= numberof(multipliers); ++i) {
+    alpha = multipliers(i);
+    for (j = 1; j <= numberof(multipliers); ++j) {
+        beta = multipliers(j);
+        z = alpha*x + beta*y;
+        write, format="vops_dist{1,2,inf}(%2d, x, %2d, y): |dif| = %.1e / %.1e / %.1e\n",
+            alpha, beta,
+            abs(vops_dist1(alpha, x, beta, y) - sum(abs(z))),
+            abs(vops_dist2(alpha, x, beta, y) - sqrt(sum(z*z))),
+            abs(vops_distinf(alpha, x, beta, y) - max(abs(z)));
+    }
+}
+write, "";
+
+// Weighted norms.
+nops = 3*numberof(x);
+
+write, format="%35s ->", "sum(w*abs(x))";
+k = repeat; vops_warmup; while (--k >= 0) r1 = sum(w*abs(x));
+write, format="%14.6g / %7.3f Gflops\n", r1, vops_flops(nops*repeat)/1e9;
+
+write, format="%35s ->", "vops_wnorm1(w, x)";
+k = repeat; vops_warmup; while (--k >= 0) r2 = vops_wnorm1(w, x);
+write, format="%14.6g / %7.3f Gflops\n\n", r2, vops_flops(nops*repeat)/1e9;
+
+write, format="%35s ->", "sqrt(sum(w*x*x))";
+k = repeat; vops_warmup; while (--k >= 0) r1 = sqrt(sum(w*x*x));
+write, format="%14.6g / %7.3f Gflops\n", r1, vops_flops(nops*repeat)/1e9;
+
+write, format="%35s ->", "vops_wnorm2(w, x)";
+k = repeat; vops_warmup; while (--k >= 0) r2 = vops_wnorm2(w, x);
+write, format="%14.6g / %7.3f Gflops\n\n", r2, vops_flops(nops*repeat)/1e9;
+
 // Scale.
 nops = numberof(x);
 alpha = random();
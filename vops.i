@@ -38,6 +38,19 @@ local vops;
      yields the inner product or "triple" innner product of the real-valued
      arrays `w`, `x`, and `y`;
 
+         vops_dist1(x, y)                       -->  sum(abs(x - y))
+         vops_dist2(x, y)                       -->  sqrt(sum((x - y)^2))
+         vops_distinf(x, y)                     -->  max(abs(x - y))
+         vops_dist2(alpha, x, beta, y)          -->  vops_norm2(alpha*x + beta*y)
+
+     yield the L1, L2 or infinite-norm of `x - y` (or of `alpha*x + beta*y`)
+     without allocating the temporary array;
+
+         vops_wnorm1(w, x)                      -->  sum(w*abs(x))
+         vops_wnorm2(w, x)                      -->  sqrt(sum(w*x*x))
+
+     yield the weighted L1 or L2 norm of `x` given the nonnegative weights `w`;
+
          vops_scale(alpha, x)                   -->  alpha*x
          vops_scale(x, alpha)                   -->  alpha*x
          vops_scale, x, alpha;                  -->  x *= alpha
@@ -60,7 +73,8 @@ local vops;
      `vops_combine` automatically redefines or re-uses the contents of `dst`.
 
 
-   SEE ALSO: vops_norm1, vops_norm2, vops_norminf, vops_inner, vops_scale,
+   SEE ALSO: vops_norm1, vops_norm2, vops_norminf, vops_inner, vops_dist1,
+             vops_dist2, vops_distinf, vops_wnorm1, vops_wnorm2, vops_scale,
              vops_update.
  */
 
@@ -71,7 +85,7 @@ extern vops_norm1;
 
           nrm = sum(abs(x));
 
-   SEE ALSO: vops, vops_norm2, vops_norminf.
+   SEE ALSO: vops, vops_dist1, vops_norm2, vops_norminf, vops_wnorm1.
  */
 
 extern vops_norm2;
@@ -82,7 +96,8 @@ extern vops_norm2;
 
           nrm = sqrt(sum(x*x));
 
-   SEE ALSO: vops, vops_inner, vops_norm1, vops_norminf.
+   SEE ALSO: vops, vops_dist2, vops_inner, vops_norm1, vops_norminf,
+             vops_wnorm2.
  */
 
 extern vops_norminf;
@@ -92,7 +107,7 @@ extern vops_norminf;
 
           nrm = max(abs(x));
 
-   SEE ALSO: vops, vops_norm1, vops_norm2.
+   SEE ALSO: vops, vops_distinf, vops_norm1, vops_norm2.
  */
 
 extern vops_inner;
@@ -109,6 +124,55 @@ extern vops_inner;
    SEE ALSO: vops, vops_norm2.
  */
 
+extern vops_dist1;
+extern vops_dist2;
+extern vops_distinf;
+/* DOCUMENT dst = vops_dist1(x, y);
+         or dst = vops_dist2(x, y);
+         or dst = vops_distinf(x, y);
+         or dst = vops_dist1(alpha, x, beta, y);
+         or dst = vops_dist2(alpha, x, beta, y);
+         or dst = vops_distinf(alpha, x, beta, y);
+
+      Compute the L1-norm, L2-norm (Euclidean norm) or infinite-norm of the
+      difference of the real-valued arrays `x` and `y`, that is:
+
+          dst = vops_norm1(x - y);
+          dst = vops_norm2(x - y);
+          dst = vops_norminf(x - y);
+
+      or, if scalar factors `alpha` and `beta` are specified, the norm of
+      `alpha*x + beta*y`:
+
+          dst = vops_norm1(vops_combine(alpha, x, beta, y));
+          dst = vops_norm2(vops_combine(alpha, x, beta, y));
+          dst = vops_norminf(vops_combine(alpha, x, beta, y));
+
+      except that the result is computed in a single pass without creating
+      any temporary array.  Arrays `x` and `y` must have the same dimensions.
+      These functions are typically used to check the convergence of
+      iterative algorithms.
+
+   SEE ALSO: vops, vops_combine, vops_norm1, vops_norm2, vops_norminf.
+ */
+
+extern vops_wnorm1;
+extern vops_wnorm2;
+/* DOCUMENT nrm = vops_wnorm1(w, x);
+         or nrm = vops_wnorm2(w, x);
+
+      Compute the weighted L1-norm or L2-norm of the real-valued array `x`
+      given the weights `w`, defined as:
+
+          nrm = sum(w*abs(x));      (for `vops_wnorm1`)
+          nrm = sqrt(sum(w*x*x));   (for `vops_wnorm2`)
+
+      except that arguments must have the same dimensions.  The weights are
+      assumed to be nonnegative, this is not checked.
+
+   SEE ALSO: vops, vops_inner, vops_norm1, vops_norm2.
+ */
+
 extern vops_scale;
 /* DOCUMENT res = vops_scale(x, alpha);
          or res = vops_scale(alpha, x);
@@ -353,6 +353,291 @@ void Y_vops_inner(int argc)
     ypush_double(res);
 }
 
+//-----------------------------------------------------------------------------
+// VOPS_DIST1, VOPS_DIST2 and VOPS_DISTINF
+
+// Norms of `alpha*x + beta*y` computed in a single pass without temporaries.
+// Factors `alpha` and `beta` are handled as in `vops_combine` to reduce the
+// number of operations, the norms being absolutely homogeneous.
+
+#define ENCODE_(func, T, abs, norm)                             \
+    static T func(                                              \
+        T                 alpha,                                \
+        const T* restrict x,                                    \
+        T                 beta,                                 \
+        const T* restrict y,                                    \
+        long              n)                                    \
+    {                                                           \
+        T s = 0;                                                \
+        if (alpha == 0) {                                       \
+            return abs(beta)*norm(y, n);                        \
+        } else if (beta == 0) {                                 \
+            return abs(alpha)*norm(x, n);                       \
+        } else if (alpha == -beta) {                            \
+            for (long i = 0; i < n; ++i) {                      \
+                s += abs(x[i] - y[i]);                          \
+            }                                                   \
+            return abs(alpha)*s;                                \
+        } else if (alpha == beta) {                             \
+            for (long i = 0; i < n; ++i) {                      \
+                s += abs(x[i] + y[i]);                          \
+            }                                                   \
+            return abs(alpha)*s;                                \
+        } else {                                                \
+            for (long i = 0; i < n; ++i) {                      \
+                s += abs(alpha*x[i] + beta*y[i]);               \
+            }                                                   \
+            return s;                                           \
+        }                                                       \
+    }
+ENCODE_(vops_dist1_flt, float,  fabsf, vops_norm1_flt);
+ENCODE_(vops_dist1_dbl, double, fabs,  vops_norm1_dbl);
+#undef ENCODE_
+
+#define ENCODE_(func, T, abs, sqrt, norm)                       \
+    static T func(                                              \
+        T                 alpha,                                \
+        const T* restrict x,                                    \
+        T                 beta,                                 \
+        const T* restrict y,                                    \
+        long              n)                                    \
+    {                                                           \
+        T s = 0;                                                \
+        if (alpha == 0) {                                       \
+            return abs(beta)*norm(y, n);                        \
+        } else if (beta == 0) {                                 \
+            return abs(alpha)*norm(x, n);                       \
+        } else if (alpha == -beta) {                            \
+            for (long i = 0; i < n; ++i) {                      \
+                T t = x[i] - y[i];                              \
+                s += t*t;                                       \
+            }                                                   \
+            return abs(alpha)*sqrt(s);                          \
+        } else if (alpha == beta) {                             \
+            for (long i = 0; i < n; ++i) {                      \
+                T t = x[i] + y[i];                              \
+                s += t*t;                                       \
+            }                                                   \
+            return abs(alpha)*sqrt(s);                          \
+        } else {                                                \
+            for (long i = 0; i < n; ++i) {                      \
+                T t = alpha*x[i] + beta*y[i];                   \
+                s += t*t;                                       \
+            }                                                   \
+            return sqrt(s);                                     \
+        }                                                       \
+    }
+ENCODE_(vops_dist2_flt, float,  fabsf, sqrtf, vops_norm2_flt);
+ENCODE_(vops_dist2_dbl, double, fabs,  sqrt,  vops_norm2_dbl);
+#undef ENCODE_
+
+#define ENCODE_(func, T, abs, max, norm)                        \
+    static T func(                                              \
+        T                 alpha,                                \
+        const T* restrict x,                                    \
+        T                 beta,                                 \
+        const T* restrict y,                                    \
+        long              n)                                    \
+    {                                                           \
+        T s = 0;                                                \
+        if (alpha == 0) {                                       \
+            return abs(beta)*norm(y, n);                        \
+        } else if (beta == 0) {                                 \
+            return abs(alpha)*norm(x, n);                       \
+        } else if (alpha == -beta) {                            \
+            for (long i = 0; i < n; ++i) {                      \
+                s = max(s, abs(x[i] - y[i]));                   \
+            }                                                   \
+            return abs(alpha)*s;                                \
+        } else if (alpha == beta) {                             \
+            for (long i = 0; i < n; ++i) {                      \
+                s = max(s, abs(x[i] + y[i]));                   \
+            }                                                   \
+            return abs(alpha)*s;                                \
+        } else {                                                \
+            for (long i = 0; i < n; ++i) {                      \
+                s = max(s, abs(alpha*x[i] + beta*y[i]));        \
+            }                                                   \
+            return s;                                           \
+        }                                                       \
+    }
+ENCODE_(vops_distinf_flt, float,  fabsf, max_flt, vops_norminf_flt);
+ENCODE_(vops_distinf_dbl, double, fabs,  max_dbl, vops_norminf_dbl);
+#undef ENCODE_
+
+// Common driver for `vops_dist1`, `vops_dist2` and `vops_distinf`.  Argument
+// `p` is the kind of norm: 1, 2 or 0 (for the infinite-norm).
+static void dist(int argc, int p, const char* usage)
+{
+    int a_iarg, x_iarg, b_iarg, y_iarg;
+    double alpha, beta;
+    if (argc == 2) {
+        a_iarg = -1;
+        x_iarg = argc - 1;
+        b_iarg = -1;
+        y_iarg = argc - 2;
+        alpha = 1;
+        beta = -1;
+    } else if (argc == 4) {
+        a_iarg = argc - 1;
+        x_iarg = argc - 2;
+        b_iarg = argc - 3;
+        y_iarg = argc - 4;
+        alpha = ygets_d(a_iarg);
+        beta = ygets_d(b_iarg);
+    } else {
+        y_error(usage);
+        return;
+    }
+    array x, y;
+    get_array(x_iarg, &x);
+    if ((unsigned)x.type > Y_DOUBLE) {
+        y_error("argument `x` is not real-valued");
+    }
+    get_array(y_iarg, &y);
+    if ((unsigned)y.type > Y_DOUBLE) {
+        y_error("argument `y` is not real-valued");
+    }
+    if (!same_dims(x.dims, y.dims)) {
+        y_error("arguments `x` and `y` must have the same dimensions");
+    }
+    int T = promote_type(x.type, y.type);
+    if (T < 0) {
+        y_error("arguments `x` and `y` have unsupported types");
+    }
+    if (T != Y_FLOAT) {
+        T = Y_DOUBLE;
+    }
+    coerce(x_iarg, &x, T);
+    coerce(y_iarg, &y, T);
+    double res;
+    if (T == Y_DOUBLE) {
+        if (p == 1) {
+            res = vops_dist1_dbl(alpha, x.data, beta, y.data, x.ntot);
+        } else if (p == 2) {
+            res = vops_dist2_dbl(alpha, x.data, beta, y.data, x.ntot);
+        } else {
+            res = vops_distinf_dbl(alpha, x.data, beta, y.data, x.ntot);
+        }
+    } else {
+        if (p == 1) {
+            res = vops_dist1_flt(alpha, x.data, beta, y.data, x.ntot);
+        } else if (p == 2) {
+            res = vops_dist2_flt(alpha, x.data, beta, y.data, x.ntot);
+        } else {
+            res = vops_distinf_flt(alpha, x.data, beta, y.data, x.ntot);
+        }
+    }
+    ypush_double(res);
+}
+
+void Y_vops_dist1(int argc)
+{
+    dist(argc, 1, "usage: vops_dist1([alpha,] x, [beta,] y)");
+}
+
+void Y_vops_dist2(int argc)
+{
+    dist(argc, 2, "usage: vops_dist2([alpha,] x, [beta,] y)");
+}
+
+void Y_vops_distinf(int argc)
+{
+    dist(argc, 0, "usage: vops_distinf([alpha,] x, [beta,] y)");
+}
+
+//-----------------------------------------------------------------------------
+// VOPS_WNORM1 and VOPS_WNORM2
+
+#define ENCODE_(func, T, abs)                   \
+    static T func(                              \
+        const T* restrict w,                    \
+        const T* restrict x,                    \
+        long n)                                 \
+    {                                           \
+        T s = 0;                                \
+        for (long i = 0; i < n; ++i) {          \
+            s += w[i]*abs(x[i]);                \
+        }                                       \
+        return s;                               \
+    }
+ENCODE_(vops_wnorm1_flt, float,  fabsf);
+ENCODE_(vops_wnorm1_dbl, double, fabs);
+#undef ENCODE_
+
+#define ENCODE_(func, T, sqrt)                  \
+    static T func(                              \
+        const T* restrict w,                    \
+        const T* restrict x,                    \
+        long n)                                 \
+    {                                           \
+        T s = 0;                                \
+        for (long i = 0; i < n; ++i) {          \
+            s += w[i]*x[i]*x[i];                \
+        }                                       \
+        return sqrt(s);                         \
+    }
+ENCODE_(vops_wnorm2_flt, float,  sqrtf);
+ENCODE_(vops_wnorm2_dbl, double, sqrt);
+#undef ENCODE_
+
+// Common driver for `vops_wnorm1` and `vops_wnorm2`.  Argument `p` is the
+// kind of norm: 1 or 2.
+static void wnorm(int argc, int p, const char* usage)
+{
+    if (argc != 2) {
+        y_error(usage);
+    }
+    int w_iarg = argc - 1;
+    int x_iarg = argc - 2;
+    array w, x;
+    get_array(w_iarg, &w);
+    if ((unsigned)w.type > Y_DOUBLE) {
+        y_error("argument `w` is not real-valued");
+    }
+    get_array(x_iarg, &x);
+    if ((unsigned)x.type > Y_DOUBLE) {
+        y_error("argument `x` is not real-valued");
+    }
+    if (!same_dims(w.dims, x.dims)) {
+        y_error("arguments `w` and `x` must have the same dimensions");
+    }
+    int T = promote_type(w.type, x.type);
+    if (T < 0) {
+        y_error("arguments `w` and `x` have unsupported types");
+    }
+    if (T != Y_FLOAT) {
+        T = Y_DOUBLE;
+    }
+    coerce(w_iarg, &w, T);
+    coerce(x_iarg, &x, T);
+    double res;
+    if (T == Y_DOUBLE) {
+        if (p == 1) {
+            res = vops_wnorm1_dbl(w.data, x.data, x.ntot);
+        } else {
+            res = vops_wnorm2_dbl(w.data, x.data, x.ntot);
+        }
+    } else {
+        if (p == 1) {
+            res = vops_wnorm1_flt(w.data, x.data, x.ntot);
+        } else {
+            res = vops_wnorm2_flt(w.data, x.data, x.ntot);
+        }
+    }
+    ypush_double(res);
+}
+
+void Y_vops_wnorm1(int argc)
+{
+    wnorm(argc, 1, "usage: vops_wnorm1(w, x)");
+}
+
+void Y_vops_wnorm2(int argc)
+{
+    wnorm(argc, 2, "usage: vops_wnorm2(w, x)");
+}
+
 //-----------------------------------------------------------------------------
 // VOPS_SCALE
 